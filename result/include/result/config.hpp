@@ -0,0 +1,10 @@
+#pragma once
+
+namespace std2
+{
+#if defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
+	inline constexpr bool is_result_checked = true;
+#else
+	inline constexpr bool is_result_checked = false;
+#endif // defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
+}
@@ -0,0 +1,405 @@
+#pragma once
+
+#include <result/config.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace std2
+{
+	template<typename... E>
+	class errors;
+
+	template<typename T, typename... Ts>
+	struct errors_contains : std::disjunction<std::is_same<T, Ts>...> {};
+
+	template<typename T, typename... Ts>
+	inline constexpr bool errors_contains_v = errors_contains<T, Ts...>::value;
+
+	template<typename T, typename... Ts>
+	struct errors_index_of;
+
+	template<typename T, typename... Ts>
+	struct errors_index_of<T, T, Ts...> : std::integral_constant<size_t, 0> {};
+
+	template<typename T, typename U, typename... Ts>
+	struct errors_index_of<T, U, Ts...> : std::integral_constant<size_t, 1 + errors_index_of<T, Ts...>::value> {};
+
+	template<typename T, typename... Ts>
+	inline constexpr size_t errors_index_of_v = errors_index_of<T, Ts...>::value;
+
+	// Smallest unsigned integer able to tell apart N alternatives.
+	template<size_t N>
+	using errors_index = std::conditional_t<N <= UINT8_MAX + 1, uint8_t, std::conditional_t<N <= UINT16_MAX + 1, uint16_t, uint32_t>>;
+
+	template<typename... E>
+	union errors_storage;
+
+	template<typename Head, typename... Tail>
+	union errors_storage<Head, Tail...>
+	{
+		template<typename... Args>
+		constexpr errors_storage(std::in_place_index_t<0>, Args&&... args)
+			noexcept(std::is_nothrow_constructible_v<Head, Args&&...>)
+			: head(std::forward<Args>(args)...)
+		{}
+
+		template<size_t I, typename... Args>
+			requires (I > 0)
+		constexpr errors_storage(std::in_place_index_t<I>, Args&&... args)
+			noexcept(std::is_nothrow_constructible_v<errors_storage<Tail...>, std::in_place_index_t<I - 1>, Args&&...>)
+			: tail(std::in_place_index<I - 1>, std::forward<Args>(args)...)
+		{}
+
+		constexpr ~errors_storage()
+			requires std::conjunction_v<std::is_trivially_destructible<Head>, std::is_trivially_destructible<Tail>...>
+		= default;
+
+		constexpr ~errors_storage() {}
+
+		Head head;
+		errors_storage<Tail...> tail;
+	};
+
+	template<typename Head>
+	union errors_storage<Head>
+	{
+		template<typename... Args>
+		constexpr errors_storage(std::in_place_index_t<0>, Args&&... args)
+			noexcept(std::is_nothrow_constructible_v<Head, Args&&...>)
+			: head(std::forward<Args>(args)...)
+		{}
+
+		constexpr ~errors_storage()
+			requires std::is_trivially_destructible_v<Head>
+		= default;
+
+		constexpr ~errors_storage() {}
+
+		Head head;
+	};
+
+	template<size_t I, typename Storage>
+		requires std::_Is_specialization<std::remove_cvref_t<Storage>, errors_storage>::value
+	[[nodiscard]] constexpr auto errors_storage_get(Storage&& storage) noexcept -> auto&&
+	{
+		if constexpr(I == 0)
+		{
+			return std::forward<Storage>(storage).head;
+		}
+		else
+		{
+			return std2::errors_storage_get<I - 1>(std::forward<Storage>(storage).tail);
+		}
+	}
+
+	template<typename... F>
+	struct errors_overload : F...
+	{
+		using F::operator()...;
+	};
+
+	template<typename E, typename... Es>
+	struct errors_append
+	{
+		using type = E;
+	};
+
+	template<typename... E, typename Head, typename... Tail>
+	struct errors_append<errors<E...>, Head, Tail...> : errors_append<std::conditional_t<errors_contains_v<Head, E...>, errors<E...>, errors<E..., Head>>, Tail...> {};
+
+	// Error type of a chain that may fail with either L or R; R itself when it already covers L.
+	template<typename L, typename R>
+	struct errors_join {};
+
+	template<typename E>
+	struct errors_join<E, E>
+	{
+		using type = E;
+	};
+
+	template<typename... L, typename... R>
+		requires std::negation_v<std::is_same<errors<L...>, errors<R...>>>
+	struct errors_join<errors<L...>, errors<R...>> : std::conditional_t<std::conjunction_v<errors_contains<L, R...>...>, errors_append<errors<R...>>, errors_append<errors<L...>, R...>> {};
+
+	template<typename L, typename R>
+	using errors_join_t = typename errors_join<L, R>::type;
+
+	template<typename L, typename R>
+	concept errors_joinable = requires { typename errors_join_t<L, R>; };
+
+	template<typename F, typename E>
+	struct is_errors_widening : std::false_type {};
+
+	template<typename... F, typename... E>
+	struct is_errors_widening<errors<F...>, errors<E...>> : std::bool_constant<std::conjunction_v<std::negation<std::is_same<errors<F...>, errors<E...>>>, errors_contains<F, E...>...>> {};
+
+	template<typename F, typename E>
+	inline constexpr bool is_errors_widening_v = is_errors_widening<F, E>::value;
+
+	template<typename... E>
+	class errors
+	{
+		static_assert(sizeof...(E) > 0, "errors must hold at least one error type");
+		static_assert(std::conjunction_v<std::is_same<E, std::remove_cvref_t<E>>...>, "errors must hold unqualified object types");
+		static_assert(std::is_same_v<typename errors_append<errors<>, E...>::type, errors>, "errors must not repeat an error type");
+
+		template<typename...>
+		friend class errors;
+
+	public:
+		using index_type = errors_index<sizeof...(E)>;
+
+		template<typename U>
+			requires errors_contains_v<std::remove_cvref_t<U>, E...>
+		constexpr errors(U&& value)
+			noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<U>, U&&>)
+			: m_storage(std::in_place_index<errors_index_of_v<std::remove_cvref_t<U>, E...>>, std::forward<U>(value)), m_index{ errors_index_of_v<std::remove_cvref_t<U>, E...> }
+		{}
+
+		constexpr errors(const errors& other)
+			noexcept(std::conjunction_v<std::is_nothrow_copy_constructible<E>...>)
+			requires std::conjunction_v<std::is_copy_constructible<E>...>
+			: m_index{ other.m_index }
+		{
+			construct_from(other, std::index_sequence_for<E...>{});
+		}
+
+		constexpr errors(errors&& other)
+			noexcept(std::conjunction_v<std::is_nothrow_move_constructible<E>...>)
+			requires std::conjunction_v<std::is_move_constructible<E>...>
+			: m_index{ other.m_index }
+		{
+			construct_from(std::move(other), std::index_sequence_for<E...>{});
+		}
+
+		template<typename... F>
+			requires std::conjunction_v<is_errors_widening<errors<F...>, errors>, std::is_copy_constructible<F>...>
+		constexpr errors(const errors<F...>& other)
+			noexcept(std::conjunction_v<std::is_nothrow_copy_constructible<F>...>)
+			: m_index{ remap<F...>[other.m_index] }
+		{
+			construct_from(other, std::index_sequence_for<F...>{});
+		}
+
+		template<typename... F>
+			requires std::conjunction_v<is_errors_widening<errors<F...>, errors>, std::is_move_constructible<F>...>
+		constexpr errors(errors<F...>&& other)
+			noexcept(std::conjunction_v<std::is_nothrow_move_constructible<F>...>)
+			: m_index{ remap<F...>[other.m_index] }
+		{
+			construct_from(std::move(other), std::index_sequence_for<F...>{});
+		}
+
+		constexpr ~errors()
+			requires std::conjunction_v<std::is_trivially_destructible<E>...>
+		= default;
+
+		constexpr ~errors()
+			noexcept(std::conjunction_v<std::is_nothrow_destructible<E>...>)
+		{
+			visit([] <typename U> (U& value) { std::destroy_at(std::addressof(value)); });
+		}
+
+		auto operator=(const errors&) -> errors& = delete;
+		auto operator=(errors&&) noexcept -> errors& = delete;
+
+		[[nodiscard]] constexpr auto index() const noexcept -> index_type
+		{
+			return m_index;
+		}
+
+		template<typename U>
+			requires errors_contains_v<U, E...>
+		[[nodiscard]] constexpr auto holds() const noexcept -> bool
+		{
+			return m_index == errors_index_of_v<U, E...>;
+		}
+
+		template<typename U>
+			requires errors_contains_v<U, E...>
+		[[nodiscard]] constexpr auto get() & noexcept -> U&
+		{
+			check(errors_index_of_v<U, E...>);
+
+			return std2::errors_storage_get<errors_index_of_v<U, E...>>(m_storage);
+		}
+
+		template<typename U>
+			requires errors_contains_v<U, E...>
+		[[nodiscard]] constexpr auto get() const& noexcept -> const U&
+		{
+			check(errors_index_of_v<U, E...>);
+
+			return std2::errors_storage_get<errors_index_of_v<U, E...>>(m_storage);
+		}
+
+		template<typename U>
+			requires errors_contains_v<U, E...>
+		[[nodiscard]] constexpr auto get() && noexcept -> U&&
+		{
+			check(errors_index_of_v<U, E...>);
+
+			return std2::errors_storage_get<errors_index_of_v<U, E...>>(std::move(m_storage));
+		}
+
+		template<typename U>
+			requires errors_contains_v<U, E...>
+		[[nodiscard]] constexpr auto get() const&& noexcept -> const U&&
+		{
+			check(errors_index_of_v<U, E...>);
+
+			return std2::errors_storage_get<errors_index_of_v<U, E...>>(std::move(m_storage));
+		}
+
+		template<typename F>
+			requires std::conjunction_v<std::is_invocable<F, E&>...>
+		constexpr auto visit(F&& func) &
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, E&>...>)
+			-> std::common_type_t<std::invoke_result_t<F, E&>...>
+		{
+			return visit_at<0, std::common_type_t<std::invoke_result_t<F, E&>...>>(*this, func);
+		}
+
+		template<typename F>
+			requires std::conjunction_v<std::is_invocable<F, const E&>...>
+		constexpr auto visit(F&& func) const&
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, const E&>...>)
+			-> std::common_type_t<std::invoke_result_t<F, const E&>...>
+		{
+			return visit_at<0, std::common_type_t<std::invoke_result_t<F, const E&>...>>(*this, func);
+		}
+
+		template<typename F>
+			requires std::conjunction_v<std::is_invocable<F, E&&>...>
+		constexpr auto visit(F&& func) &&
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, E&&>...>)
+			-> std::common_type_t<std::invoke_result_t<F, E&&>...>
+		{
+			return visit_at<0, std::common_type_t<std::invoke_result_t<F, E&&>...>>(std::move(*this), func);
+		}
+
+		template<typename F>
+			requires std::conjunction_v<std::is_invocable<F, const E&&>...>
+		constexpr auto visit(F&& func) const&&
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, const E&&>...>)
+			-> std::common_type_t<std::invoke_result_t<F, const E&&>...>
+		{
+			return visit_at<0, std::common_type_t<std::invoke_result_t<F, const E&&>...>>(std::move(*this), func);
+		}
+
+		template<typename... F>
+		constexpr auto match(F&&... funcs) & -> decltype(auto)
+		{
+			return visit(errors_overload<std::decay_t<F>...>{ std::forward<F>(funcs)... });
+		}
+
+		template<typename... F>
+		constexpr auto match(F&&... funcs) const& -> decltype(auto)
+		{
+			return visit(errors_overload<std::decay_t<F>...>{ std::forward<F>(funcs)... });
+		}
+
+		template<typename... F>
+		constexpr auto match(F&&... funcs) && -> decltype(auto)
+		{
+			return std::move(*this).visit(errors_overload<std::decay_t<F>...>{ std::forward<F>(funcs)... });
+		}
+
+		template<typename... F>
+		constexpr auto match(F&&... funcs) const&& -> decltype(auto)
+		{
+			return std::move(*this).visit(errors_overload<std::decay_t<F>...>{ std::forward<F>(funcs)... });
+		}
+
+	private:
+		template<size_t I, typename R, typename Self, typename F>
+		static constexpr auto visit_at(Self&& self, F& func) -> R
+		{
+			if constexpr(I + 1 < sizeof...(E))
+			{
+				if(self.m_index != I)
+				{
+					return visit_at<I + 1, R>(std::forward<Self>(self), func);
+				}
+			}
+
+			return std::invoke(func, std2::errors_storage_get<I>(std::forward<Self>(self).m_storage));
+		}
+
+		// Index of each alternative of a set of the same or fewer types within this one.
+		template<typename... F>
+		static constexpr std::array<index_type, sizeof...(F)> remap{ static_cast<index_type>(errors_index_of_v<F, E...>)... };
+
+		template<size_t I, typename Other>
+		static constexpr auto construct_alternative(errors& self, Other&& other) -> void
+		{
+			using alternative = std::remove_cvref_t<decltype(std2::errors_storage_get<I>(other.m_storage))>;
+
+			std::construct_at(std::addressof(self.m_storage), std::in_place_index<errors_index_of_v<alternative, E...>>, std2::errors_storage_get<I>(std::forward<Other>(other).m_storage));
+		}
+
+		// Copies or moves the active alternative of other into its remapped slot through a table indexed by other's index.
+		template<typename Other, size_t... I>
+		constexpr auto construct_from(Other&& other, std::index_sequence<I...>) -> void
+		{
+			constexpr std::array<void (*)(errors&, Other&&), sizeof...(I)> constructors{ &errors::construct_alternative<I, Other>... };
+
+			constructors[other.m_index](*this, std::forward<Other>(other));
+		}
+
+		constexpr auto check(size_t index) const noexcept -> void
+		{
+			if((is_result_checked || std::is_constant_evaluated()) && m_index != index)
+			{
+				std::abort();
+			}
+		}
+
+		union
+		{
+			errors_storage<E...> m_storage;
+		};
+		index_type m_index;
+	};
+}
+
+namespace std
+{
+	template<typename... E>
+		requires std::conjunction_v<std::is_default_constructible<hash<E>>...>
+	struct hash<std2::errors<E...>>
+	{
+		[[nodiscard]] constexpr auto operator()(const std2::errors<E...>& errors) const noexcept -> size_t
+		{
+			const size_t value_hash = errors.visit([] <typename U> (const U& value) -> size_t { return hash<U>{}(value); });
+
+			return value_hash ^ (hash<size_t>{}(errors.index()) + 0x9e3779b9 + (value_hash << 6) + (value_hash >> 2));
+		}
+	};
+
+	template<typename... E, typename CharT>
+		requires std::conjunction_v<std::is_default_constructible<formatter<E, CharT>>...>
+	struct formatter<std2::errors<E...>, CharT>
+	{
+		template<typename FormatContext>
+		auto format(const std2::errors<E...>& errors, FormatContext& context) const -> typename FormatContext::iterator
+		{
+			return errors.visit([&context] (const auto& value) { return std::format_to(context.out(), "{}", value); });
+		}
+
+		template<typename ParseContext>
+		constexpr auto parse(ParseContext& context) noexcept -> typename ParseContext::iterator
+		{
+			return context.end();
+		}
+	};
+}
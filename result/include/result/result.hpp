@@ -1,9 +1,14 @@
 #pragma once
 
+#include <result/config.hpp>
+#include <result/errors.hpp>
+
 #include <concepts>
+#include <cstdint>
 #include <cstdlib>
 #include <format>
 #include <functional>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -68,6 +73,23 @@ namespace std2
 	template<typename F, typename E, typename... Args>
 	concept invoke_result_result_with_err = is_invoke_result_result_with_err_v<F, E, Args...>;
 
+	template<typename F, typename E, typename... Args>
+	struct is_invoke_result_result_with_joinable_err : std::bool_constant<std::conjunction_v<std::_Is_specialization<std::invoke_result_t<F, Args...>, result>, std::bool_constant<errors_joinable<E, typename std::invoke_result_t<F, Args...>::err_type>>>> {};
+
+	template<typename F, typename E, typename... Args>
+	inline constexpr bool is_invoke_result_result_with_joinable_err_v = is_invoke_result_result_with_joinable_err<F, E, Args...>::value;
+
+	template<typename F, typename E, typename... Args>
+	concept invoke_result_result_with_joinable_err = is_invoke_result_result_with_joinable_err_v<F, E, Args...>;
+
+	// Result of chaining R after a result failing with E; same as R unless both error types are error sets.
+	template<typename R, typename E>
+	using joined_result_t = result<typename R::ok_type, errors_join_t<E, typename R::err_type>>;
+
+	// Whether and_then can convert both the continuation's result and its own error into joined_result_t<R, E> without throwing.
+	template<typename R, typename E>
+	struct is_nothrow_joinable : std::bool_constant<std::conjunction_v<std::disjunction<std::is_same<R, joined_result_t<R, E>>, std::is_nothrow_constructible<joined_result_t<R, E>, R>>, std::is_nothrow_constructible<joined_result_t<R, E>, err_value<E>>>> {};
+
 	template<typename F, typename T, typename... Args>
 	struct is_invoke_result_result_with_ok : std::bool_constant<std::conjunction_v<std::_Is_specialization<std::invoke_result_t<F, Args...>, result>, std::is_same<typename std::invoke_result_t<F, Args...>::ok_type, T>>> {};
 
@@ -96,19 +118,39 @@ namespace std2
 			: m_err(std::move(err.value)), m_is_ok{ false }
 		{}
 
+		template<typename F>
+			requires is_errors_widening_v<F, E>
+		constexpr result(result<T, F>&& other)
+			noexcept(std::conjunction_v<std::is_nothrow_move_constructible<result_storage<T>>, std::is_nothrow_constructible<E, F&&>>)
+			: m_is_ok{ other.m_is_ok }
+		{
+			if(m_is_ok)
+			{
+				std::construct_at(std::addressof(m_ok), std::move(other.m_ok));
+			}
+			else
+			{
+				std::construct_at(std::addressof(m_err), std::move(other.m_err));
+			}
+		}
+
 		result(const result&) = delete;
 		result(result&&) noexcept = delete;
 
 		constexpr ~result()
-			noexcept(std::conjunction_v<std::is_nothrow_destructible<T>, std::is_nothrow_destructible<E>>)
+			requires std::conjunction_v<std::is_trivially_destructible<result_storage<T>>, std::is_trivially_destructible<result_storage<E>>>
+		= default;
+
+		constexpr ~result()
+			noexcept(std::conjunction_v<std::is_nothrow_destructible<result_storage<T>>, std::is_nothrow_destructible<result_storage<E>>>)
 		{
 			if(m_is_ok)
 			{
-				m_ok.~decltype(m_ok)();
+				std::destroy_at(std::addressof(m_ok));
 			}
 			else
 			{
-				m_err.~decltype(m_err)();
+				std::destroy_at(std::addressof(m_err));
 			}
 		}
 
@@ -134,12 +176,8 @@ namespace std2
 			requires std::negation_v<std::is_void<T>>
 		[[nodiscard]] constexpr auto ok() & noexcept -> result_storage<T>&
 		{
-#if defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
-			if(!m_is_ok)
-			{
-				std::abort();
-			}
-#endif // !defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
+			check(true);
+
 			return m_ok;
 		}
 
@@ -147,12 +185,7 @@ namespace std2
 			requires std::negation_v<std::is_void<T>>
 		[[nodiscard]] constexpr auto ok() const& noexcept -> const result_storage<T>&
 		{
-#if defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
-			if(!m_is_ok)
-			{
-				std::abort();
-			}
-#endif // !defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
+			check(true);
 
 			return m_ok;
 		}
@@ -161,12 +194,7 @@ namespace std2
 			requires std::negation_v<std::is_void<T>>
 		[[nodiscard]] constexpr auto ok() && noexcept -> result_storage<T>&&
 		{
-#if defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
-			if(!m_is_ok)
-			{
-				std::abort();
-			}
-#endif // !defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
+			check(true);
 
 			return std::move(m_ok);
 		}
@@ -175,12 +203,7 @@ namespace std2
 			requires std::negation_v<std::is_void<T>>
 		[[nodiscard]] constexpr auto ok() const&& noexcept -> const result_storage<T>&&
 		{
-#if defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
-			if(!m_is_ok)
-			{
-				std::abort();
-			}
-#endif // !defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
+			check(true);
 
 			return std::move(m_ok);
 		}
@@ -211,12 +234,7 @@ namespace std2
 			requires std::negation_v<std::is_void<E>>
 		[[nodiscard]] constexpr auto err() & noexcept -> result_storage<E>&
 		{
-#if defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
-			if(m_is_ok)
-			{
-				std::abort();
-			}
-#endif // !defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
+			check(false);
 
 			return m_err;
 		}
@@ -225,12 +243,7 @@ namespace std2
 			requires std::negation_v<std::is_void<E>>
 		[[nodiscard]] constexpr auto err() const& noexcept -> const result_storage<E>&
 		{
-#if defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
-			if(m_is_ok)
-			{
-				std::abort();
-			}
-#endif // !defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
+			check(false);
 
 			return m_err;
 		}
@@ -239,12 +252,7 @@ namespace std2
 			requires std::negation_v<std::is_void<E>>
 		[[nodiscard]] constexpr auto err() && noexcept -> result_storage<E>&&
 		{
-#if defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
-			if(m_is_ok)
-			{
-				std::abort();
-			}
-#endif // !defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
+			check(false);
 
 			return std::move(m_err);
 		}
@@ -253,12 +261,7 @@ namespace std2
 			requires std::negation_v<std::is_void<E>>
 		[[nodiscard]] constexpr auto err() const&& noexcept -> const result_storage<E>&&
 		{
-#if defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
-			if(m_is_ok)
-			{
-				std::abort();
-			}
-#endif // !defined STD2_DEBUG || defined STD2_RESULT_FORCE_CHECK
+			check(false);
 
 			return std::move(m_err);
 		}
@@ -286,10 +289,10 @@ namespace std2
 		}
 
 		template<std::invocable<> F>
-			requires std::conjunction_v<std::is_void<T>, is_invoke_result_result_with_err<F, E>>
+			requires std::conjunction_v<std::is_void<T>, is_invoke_result_result_with_joinable_err<F, E>>
 		[[nodiscard]] constexpr auto and_then(F&& func) &
-			noexcept(std::conjunction_v<std::is_nothrow_invocable<F>, std::is_nothrow_invocable<decltype(std2::err<std::add_lvalue_reference_t<E>>), result_storage<E>&>>)
-			-> std::invoke_result_t<F>
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F>, std::is_nothrow_invocable<decltype(std2::err<std::add_lvalue_reference_t<E>>), result_storage<E>&>, is_nothrow_joinable<std::invoke_result_t<F>, E>>)
+			-> joined_result_t<std::invoke_result_t<F>, E>
 		{
 			if(m_is_ok)
 			{
@@ -300,10 +303,10 @@ namespace std2
 		}
 
 		template<std::invocable<result_storage<T>&> F>
-			requires std::conjunction_v<std::negation<std::is_void<T>>, is_invoke_result_result_with_err<F, E, result_storage<T>&>>
+			requires std::conjunction_v<std::negation<std::is_void<T>>, is_invoke_result_result_with_joinable_err<F, E, result_storage<T>&>>
 		[[nodiscard]] constexpr auto and_then(F&& func) &
-			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, result_storage<T>&>, std::is_nothrow_invocable<decltype(std2::err<std::add_lvalue_reference_t<E>>), result_storage<E>&>>)
-			-> std::invoke_result_t<F, result_storage<T>&>
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, result_storage<T>&>, std::is_nothrow_invocable<decltype(std2::err<std::add_lvalue_reference_t<E>>), result_storage<E>&>, is_nothrow_joinable<std::invoke_result_t<F, result_storage<T>&>, E>>)
+			-> joined_result_t<std::invoke_result_t<F, result_storage<T>&>, E>
 		{
 			if(m_is_ok)
 			{
@@ -314,10 +317,10 @@ namespace std2
 		}
 
 		template<std::invocable<> F>
-			requires std::conjunction_v<std::is_void<T>, is_invoke_result_result_with_err<F, E>>
+			requires std::conjunction_v<std::is_void<T>, is_invoke_result_result_with_joinable_err<F, E>>
 		[[nodiscard]] constexpr auto and_then(F&& func) const&
-			noexcept(std::conjunction_v<std::is_nothrow_invocable<F>, std::is_nothrow_invocable<decltype(std2::err<std::add_lvalue_reference_t<const E>>), const result_storage<E>&>>)
-			-> std::invoke_result_t<F>
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F>, std::is_nothrow_invocable<decltype(std2::err<std::add_lvalue_reference_t<const E>>), const result_storage<E>&>, is_nothrow_joinable<std::invoke_result_t<F>, E>>)
+			-> joined_result_t<std::invoke_result_t<F>, E>
 		{
 			if(m_is_ok)
 			{
@@ -328,10 +331,10 @@ namespace std2
 		}
 
 		template<std::invocable<const result_storage<T>&> F>
-			requires std::conjunction_v<std::negation<std::is_void<T>>, is_invoke_result_result_with_err<F, E, const result_storage<T>&>>
+			requires std::conjunction_v<std::negation<std::is_void<T>>, is_invoke_result_result_with_joinable_err<F, E, const result_storage<T>&>>
 		[[nodiscard]] constexpr auto and_then(F&& func) const&
-			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, const result_storage<T>&>, std::is_nothrow_invocable<decltype(std2::err<std::add_lvalue_reference_t<const E>>), const result_storage<E>&>>)
-			-> std::invoke_result_t<F, const result_storage<T>&>
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, const result_storage<T>&>, std::is_nothrow_invocable<decltype(std2::err<std::add_lvalue_reference_t<const E>>), const result_storage<E>&>, is_nothrow_joinable<std::invoke_result_t<F, const result_storage<T>&>, E>>)
+			-> joined_result_t<std::invoke_result_t<F, const result_storage<T>&>, E>
 		{
 			if(m_is_ok)
 			{
@@ -342,10 +345,10 @@ namespace std2
 		}
 
 		template<std::invocable<> F>
-			requires std::conjunction_v<std::is_void<T>, is_invoke_result_result_with_err<F, E>>
+			requires std::conjunction_v<std::is_void<T>, is_invoke_result_result_with_joinable_err<F, E>>
 		[[nodiscard]] constexpr auto and_then(F&& func) &&
-			noexcept(std::conjunction_v<std::is_nothrow_invocable<F>, std::is_nothrow_invocable<decltype(std2::err<E>), result_storage<E>&&>>)
-			-> std::invoke_result_t<F>
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F>, std::is_nothrow_invocable<decltype(std2::err<E>), result_storage<E>&&>, is_nothrow_joinable<std::invoke_result_t<F>, E>>)
+			-> joined_result_t<std::invoke_result_t<F>, E>
 		{
 			if(m_is_ok)
 			{
@@ -356,10 +359,10 @@ namespace std2
 		}
 
 		template<std::invocable<result_storage<T>&&> F>
-			requires std::conjunction_v<std::negation<std::is_void<T>>, is_invoke_result_result_with_err<F, E, result_storage<T>&&>>
+			requires std::conjunction_v<std::negation<std::is_void<T>>, is_invoke_result_result_with_joinable_err<F, E, result_storage<T>&&>>
 		[[nodiscard]] constexpr auto and_then(F&& func) &&
-			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, result_storage<T>&&>, std::is_nothrow_invocable<decltype(std2::err<E>), result_storage<E>&&>>)
-			-> std::invoke_result_t<F, result_storage<T>&&>
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, result_storage<T>&&>, std::is_nothrow_invocable<decltype(std2::err<E>), result_storage<E>&&>, is_nothrow_joinable<std::invoke_result_t<F, result_storage<T>&&>, E>>)
+			-> joined_result_t<std::invoke_result_t<F, result_storage<T>&&>, E>
 		{
 			if(m_is_ok)
 			{
@@ -370,10 +373,10 @@ namespace std2
 		}
 
 		template<std::invocable<> F>
-			requires std::conjunction_v<std::is_void<T>, is_invoke_result_result_with_err<F, E>>
+			requires std::conjunction_v<std::is_void<T>, is_invoke_result_result_with_joinable_err<F, E>>
 		[[nodiscard]] constexpr auto and_then(F&& func) const&&
-			noexcept(std::conjunction_v<std::is_nothrow_invocable<F>, std::is_nothrow_invocable<decltype(std2::err<const E>), const result_storage<E>&&>>)
-			-> std::invoke_result_t<F>
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F>, std::is_nothrow_invocable<decltype(std2::err<const E>), const result_storage<E>&&>, is_nothrow_joinable<std::invoke_result_t<F>, E>>)
+			-> joined_result_t<std::invoke_result_t<F>, E>
 		{
 			if(m_is_ok)
 			{
@@ -384,10 +387,10 @@ namespace std2
 		}
 
 		template<std::invocable<const result_storage<T>&&> F>
-			requires std::conjunction_v<std::negation<std::is_void<T>>, is_invoke_result_result_with_err<F, E, const result_storage<T>&&>>
+			requires std::conjunction_v<std::negation<std::is_void<T>>, is_invoke_result_result_with_joinable_err<F, E, const result_storage<T>&&>>
 		[[nodiscard]] constexpr auto and_then(F&& func) const&&
-			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, const result_storage<T>&&>, std::is_nothrow_invocable<decltype(std2::err<const E>), const result_storage<E>&&>>)
-			-> std::invoke_result_t<F, const result_storage<T>&&>
+			noexcept(std::conjunction_v<std::is_nothrow_invocable<F, const result_storage<T>&&>, std::is_nothrow_invocable<decltype(std2::err<const E>), const result_storage<E>&&>, is_nothrow_joinable<std::invoke_result_t<F, const result_storage<T>&&>, E>>)
+			-> joined_result_t<std::invoke_result_t<F, const result_storage<T>&&>, E>
 		{
 			if(m_is_ok)
 			{
@@ -618,10 +621,22 @@ namespace std2
 				return std::invoke(func, std::move(m_err));
 			}
 
-			return std2::ok<const T>>(std::move(m_ok));
+			return std2::ok<const T>(std::move(m_ok));
 		}
 
 	private:
+		template<typename, typename>
+		friend class result;
+
+		constexpr auto check(bool is_ok) const noexcept -> void
+		{
+			// Always checked during constant evaluation, where std::abort turns misuse into a compile error.
+			if((is_result_checked || std::is_constant_evaluated()) && m_is_ok != is_ok)
+			{
+				std::abort();
+			}
+		}
+
 		union
 		{
 			result_storage<T> m_ok;
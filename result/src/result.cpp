@@ -1 +1,206 @@
 #include <result/result.hpp>
+
+#include <array>
+#include <string_view>
+
+namespace
+{
+	using namespace std2;
+
+	// Non-trivially destructible payload, used to check that results holding one stay usable in constant evaluation.
+	struct boxed
+	{
+		constexpr boxed(int value) noexcept
+			: value{ new int{ value } }
+		{}
+
+		boxed(const boxed&) = delete;
+
+		constexpr boxed(boxed&& other) noexcept
+			: value{ std::exchange(other.value, nullptr) }
+		{}
+
+		constexpr ~boxed()
+		{
+			delete value;
+		}
+
+		int* value;
+	};
+
+	constexpr auto parse_digit(char c) noexcept -> result<int, char>
+	{
+		if(c < '0' || c > '9')
+		{
+			return std2::err(c);
+		}
+
+		return std2::ok(c - '0');
+	}
+
+	constexpr auto make_boxed(int value) -> result<boxed, boxed>
+	{
+		if(value < 0)
+		{
+			return std2::err(boxed{ -value });
+		}
+
+		return std2::ok(boxed{ value });
+	}
+
+	constexpr auto unbox(const result<boxed, boxed>& result) -> int
+	{
+		return result.is_ok()
+			? *result.ok().value
+			: -*result.err().value;
+	}
+
+	constexpr auto parse_digits(std::string_view digits) noexcept -> std::array<int, 4>
+	{
+		std::array<int, 4> table{};
+		for(size_t i = 0; i < table.size(); ++i)
+		{
+			table[i] = parse_digit(digits[i]).ok_or(-1);
+		}
+
+		return table;
+	}
+
+	constexpr result<int, char> constant_ok = std2::ok(7);
+	constexpr result<int, char> constant_err = std2::err('x');
+	constexpr result<void, char> constant_void_ok = std2::ok();
+	constexpr result<int, void> constant_void_err = std2::err();
+
+	static_assert(constant_ok && constant_ok.is_ok() && !constant_ok.is_err());
+	static_assert(!constant_err && constant_err.is_err() && !constant_err.is_ok());
+	static_assert(constant_void_ok.is_ok() && constant_void_err.is_err());
+
+	static_assert(constant_ok.ok() == 7);
+	static_assert(std::move(constant_ok).ok() == 7);
+	static_assert(parse_digit('3').ok() == 3);
+	static_assert([] { auto result = parse_digit('3'); return result.ok(); }() == 3);
+
+	static_assert(constant_err.err() == 'x');
+	static_assert(std::move(constant_err).err() == 'x');
+	static_assert(parse_digit('x').err() == 'x');
+	static_assert([] { auto result = parse_digit('x'); return result.err(); }() == 'x');
+
+	static_assert(constant_ok.ok_or(0) == 7 && constant_err.ok_or(0) == 0);
+	static_assert(parse_digit('3').ok_or(0) == 3 && parse_digit('x').ok_or(0) == 0);
+	static_assert(constant_err.err_or('?') == 'x' && constant_ok.err_or('?') == '?');
+	static_assert(parse_digit('x').err_or('?') == 'x' && parse_digit('3').err_or('?') == '?');
+
+	static_assert(constant_ok.and_then([] (int value) { return parse_digit(static_cast<char>('0' + value + 1)); }).ok() == 8);
+	static_assert(constant_err.and_then([] (int value) { return parse_digit(static_cast<char>('0' + value)); }).err() == 'x');
+	static_assert(parse_digit('3').and_then([] (int&& value) { return parse_digit(static_cast<char>('0' + value * 2)); }).ok() == 6);
+	static_assert([] { auto result = parse_digit('3'); return result.and_then([] (int& value) { return parse_digit(static_cast<char>('0' + value)); }).ok(); }() == 3);
+	static_assert(std::move(constant_ok).and_then([] (const int&& value) { return parse_digit(static_cast<char>('0' + value)); }).ok() == 7);
+	static_assert(constant_void_ok.and_then([] { return parse_digit('5'); }).ok() == 5);
+
+	static_assert(constant_ok.transform([] (int value) { return value * 2; }).ok() == 14);
+	static_assert(constant_err.transform([] (int value) { return value * 2; }).err() == 'x');
+	static_assert(parse_digit('4').transform([] (int&& value) { return value + 1; }).ok() == 5);
+	static_assert([] { auto result = parse_digit('4'); return result.transform([] (int& value) { return value + 2; }).ok(); }() == 6);
+	static_assert(std::move(constant_ok).transform([] (const int&& value) { return value + 3; }).ok() == 10);
+	static_assert(constant_void_ok.transform([] { return 1; }).ok() == 1);
+
+	static_assert(constant_err.or_else([] (char) -> result<int, char> { return std2::ok(0); }).ok() == 0);
+	static_assert(constant_ok.or_else([] (char) -> result<int, char> { return std2::ok(0); }).ok() == 7);
+	static_assert(parse_digit('x').or_else([] (char&& value) -> result<int, char> { return std2::err(static_cast<char>(value + 1)); }).err() == 'y');
+	static_assert([] { auto result = parse_digit('x'); return result.or_else([] (char& value) { return parse_digit(value); }).err(); }() == 'x');
+	static_assert(std::move(constant_err).or_else([] (const char&&) -> result<int, char> { return std2::ok(1); }).ok() == 1);
+	static_assert(constant_void_err.or_else([] () -> result<int, void> { return std2::ok(2); }).ok() == 2);
+
+	static_assert(unbox(make_boxed(3)) == 3 && unbox(make_boxed(-3)) == -3);
+	static_assert(make_boxed(3).transform([] (boxed&& value) { return *value.value * 2; }).ok() == 6);
+	static_assert(make_boxed(-3).and_then([] (boxed&& value) { return make_boxed(*value.value); }).transform([] (boxed&&) { return 0; }).err().value[0] == 3);
+
+	static_assert(parse_digits("12x4") == std::array{ 1, 2, -1, 4 });
+
+	struct bad_digit
+	{
+		char digit;
+	};
+
+	struct overflow
+	{
+		int value;
+	};
+
+	struct empty_input {};
+
+	constexpr auto parse_checked_digit(char c) noexcept -> result<int, errors<bad_digit>>
+	{
+		return parse_digit(c).ok_or(-1) < 0
+			? result<int, errors<bad_digit>>{ std2::err(bad_digit{ c }) }
+			: result<int, errors<bad_digit>>{ std2::ok(c - '0') };
+	}
+
+	constexpr auto check_overflow(int value) noexcept -> result<int, errors<overflow, bad_digit>>
+	{
+		if(value > 5)
+		{
+			return std2::err(overflow{ value });
+		}
+
+		return std2::ok(value);
+	}
+
+	constexpr auto classify(const errors<bad_digit, overflow, empty_input>& error) noexcept -> int
+	{
+		return error.match(
+			[] (const bad_digit& value) { return static_cast<int>(value.digit); },
+			[] (const overflow& value) { return -value.value; },
+			[] (const empty_input&) { return 0; });
+	}
+
+	static_assert(sizeof(errors<bad_digit, overflow>) == 2 * sizeof(int));
+	static_assert(std::is_same_v<errors<bad_digit, overflow>::index_type, uint8_t>);
+	static_assert(std::is_same_v<errors_index<256>, uint8_t> && std::is_same_v<errors_index<257>, uint16_t>);
+	static_assert(std::is_same_v<errors_join_t<errors<bad_digit>, errors<overflow, bad_digit>>, errors<overflow, bad_digit>>);
+	static_assert(std::is_same_v<errors_join_t<errors<bad_digit, empty_input>, errors<overflow, bad_digit>>, errors<bad_digit, empty_input, overflow>>);
+	static_assert(std::is_same_v<errors_join_t<errors<bad_digit>, errors<bad_digit>>, errors<bad_digit>>);
+	static_assert(std::is_same_v<errors_join_t<char, char>, char>);
+	static_assert(!errors_joinable<char, errors<bad_digit>>);
+
+	static_assert(errors<bad_digit, overflow>{ overflow{ 3 } }.index() == 1);
+	static_assert(errors<bad_digit, overflow>{ overflow{ 3 } }.holds<overflow>());
+	static_assert(errors<bad_digit, overflow>{ overflow{ 3 } }.get<overflow>().value == 3);
+	static_assert(errors<bad_digit, overflow>{ bad_digit{ 'x' } }.visit([] (const auto& value) { return sizeof(value); }) == sizeof(bad_digit));
+	static_assert(errors<bad_digit, overflow, empty_input>{ errors<overflow, bad_digit>{ bad_digit{ 'x' } } }.index() == 0);
+	static_assert(classify(errors<overflow, bad_digit>{ overflow{ 7 } }) == -7);
+	static_assert(classify(errors<empty_input>{ empty_input{} }) == 0);
+	static_assert(errors<boxed, overflow>{ boxed{ 4 } }.match([] (const boxed& value) { return *value.value; }, [] (const overflow& value) { return value.value; }) == 4);
+
+	static_assert(std::is_same_v<decltype(parse_checked_digit('3').and_then(check_overflow)), result<int, errors<overflow, bad_digit>>>);
+	static_assert(parse_checked_digit('3').and_then(check_overflow).ok() == 3);
+	static_assert(parse_checked_digit('x').and_then(check_overflow).err().get<bad_digit>().digit == 'x');
+	static_assert(parse_checked_digit('7').and_then(check_overflow).err().holds<overflow>());
+	static_assert(classify(parse_checked_digit('9').and_then(check_overflow).err()) == -9);
+
+	struct throwing_move
+	{
+		throwing_move() = default;
+		throwing_move(throwing_move&&) noexcept(false) {}
+	};
+
+	constexpr auto box_overflow(int value) -> result<int, errors<boxed>>
+	{
+		return std2::err(boxed{ value });
+	}
+
+	constexpr auto unbox_error(errors<overflow, boxed>&& error) -> int
+	{
+		return std::move(error).match([] (boxed&& value) { return boxed{ std::move(value) }.value[0]; }, [] (overflow&&) { return 0; });
+	}
+
+	static_assert(!std::is_copy_constructible_v<errors<boxed>> && !std::is_constructible_v<errors<overflow, boxed>, const errors<boxed>&>);
+	static_assert(std::is_move_constructible_v<errors<boxed>> && std::is_constructible_v<errors<overflow, boxed>, errors<boxed>&&>);
+	static_assert(errors<boxed, overflow>{ errors<boxed, overflow>{ boxed{ 5 } } }.get<boxed>().value[0] == 5);
+	static_assert(unbox_error(errors<overflow, boxed>{ errors<boxed>{ boxed{ 6 } } }) == 6);
+	static_assert(check_overflow(8).and_then(box_overflow).err().get<overflow>().value == 8);
+	static_assert(check_overflow(2).and_then(box_overflow).err().get<boxed>().value[0] == 2);
+
+	static_assert(noexcept(parse_checked_digit('3').and_then(check_overflow)));
+	static_assert(!noexcept(parse_checked_digit('3').and_then([] (int) noexcept -> result<int, errors<throwing_move>> { return std2::ok(0); })));
+}